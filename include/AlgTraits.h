@@ -0,0 +1,71 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef AlgTraits_h
+#define AlgTraits_h
+
+#include <stk_topology/topology.hpp>
+
+namespace sierra{
+namespace nalu{
+
+// compile-time element sizes for topology specialized assembly; must agree
+// with the corresponding MasterElement (checked at bucket dispatch)
+
+struct AlgTraitsHex8 {
+  static const int nDim_ = 3;
+  static const int nodesPerElement_ = 8;
+  static const int numScsIp_ = 12;
+  static const int numScvIp_ = 8;
+  static stk::topology::topology_t topo() { return stk::topology::HEX_8; }
+};
+
+struct AlgTraitsTet4 {
+  static const int nDim_ = 3;
+  static const int nodesPerElement_ = 4;
+  static const int numScsIp_ = 6;
+  static const int numScvIp_ = 4;
+  static stk::topology::topology_t topo() { return stk::topology::TET_4; }
+};
+
+struct AlgTraitsPyr5 {
+  static const int nDim_ = 3;
+  static const int nodesPerElement_ = 5;
+  static const int numScsIp_ = 8;
+  static const int numScvIp_ = 5;
+  static stk::topology::topology_t topo() { return stk::topology::PYRAMID_5; }
+};
+
+struct AlgTraitsWed6 {
+  static const int nDim_ = 3;
+  static const int nodesPerElement_ = 6;
+  static const int numScsIp_ = 9;
+  static const int numScvIp_ = 6;
+  static stk::topology::topology_t topo() { return stk::topology::WEDGE_6; }
+};
+
+struct AlgTraitsQuad4_2D {
+  static const int nDim_ = 2;
+  static const int nodesPerElement_ = 4;
+  static const int numScsIp_ = 4;
+  static const int numScvIp_ = 4;
+  static stk::topology::topology_t topo() { return stk::topology::QUAD_4_2D; }
+};
+
+struct AlgTraitsTri3_2D {
+  static const int nDim_ = 2;
+  static const int nodesPerElement_ = 3;
+  static const int numScsIp_ = 3;
+  static const int numScvIp_ = 3;
+  static stk::topology::topology_t topo() { return stk::topology::TRI_3_2D; }
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
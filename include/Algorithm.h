@@ -9,6 +9,7 @@
 #ifndef Algorithm_h
 #define Algorithm_h
 
+#include <string>
 #include <vector>
 
 namespace stk {
@@ -44,9 +45,15 @@ public:
 
   virtual void pre_work() {}
 
+  // profiling timer; class and part names, built on first use
+  const std::string &timer_name();
+
   Realm &realm_;
   stk::mesh::PartVector partVec_;
   std::vector<SupplementalAlgorithm *> supplementalAlg_;
+
+private:
+  std::string timerName_;
 };
 
 } // namespace nalu
@@ -12,6 +12,7 @@
 #include<Enums.h>
 
 #include<map>
+#include<string>
 
 namespace sierra{
 namespace nalu{
@@ -24,15 +25,23 @@ class AlgorithmDriver
 public:
 
   AlgorithmDriver(
-    Realm &realm);
+    Realm &realm,
+    const std::string &name = "");
   virtual ~AlgorithmDriver();
 
   virtual void pre_work(){};
   virtual void execute();
   virtual void post_work(){};
 
+  // class name plus name_; built on first use
+  const std::string &timer_name();
+
   Realm &realm_;
+  const std::string name_;
   std::map<AlgorithmType, Algorithm *> algMap_;
+
+private:
+  std::string timerName_;
 };
 
 } // namespace nalu
@@ -22,6 +22,7 @@ namespace sierra{
 namespace nalu{
 
 class Realm;
+class EdgeColoring;
 
 class AssembleContinuityEdgeSolverAlgorithm : public SolverAlgorithm
 {
@@ -31,7 +32,7 @@ public:
     Realm &realm,
     stk::mesh::Part *part,
     EquationSystem *eqSystem);
-  virtual ~AssembleContinuityEdgeSolverAlgorithm() {}
+  virtual ~AssembleContinuityEdgeSolverAlgorithm();
   virtual void initialize_connectivity();
   virtual void execute();
 
@@ -43,6 +44,8 @@ public:
   ScalarFieldType *pressure_;
   ScalarFieldType *density_;
   VectorFieldType *edgeAreaVec_;
+
+  EdgeColoring *edgeColoring_;
 };
 
 } // namespace nalu
@@ -15,6 +15,7 @@
 namespace stk {
 namespace mesh {
 class Part;
+class Bucket;
 }
 }
 
@@ -35,6 +36,11 @@ public:
   virtual void initialize_connectivity();
   virtual void execute();
 
+  // bucket assembly specialized on the element topology
+  template<class AlgTraits>
+  void execute_bucket(
+    stk::mesh::Bucket & b);
+
   const bool meshMotion_;
 
   // extract fields; nodal
@@ -48,6 +54,14 @@ public:
   const bool shiftPoisson_;
   const bool reducedSensitivities_;
 
+  // cached element geometry; NULL when not active
+  GenericFieldType *scsAreaVec_;
+  GenericFieldType *scsDndx_;
+
+  // time scale and interpolation options; refreshed each execute
+  double projTimeScale_;
+  double interpTogether_;
+
 };
 
 } // namespace nalu
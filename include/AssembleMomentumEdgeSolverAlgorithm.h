@@ -16,6 +16,7 @@ namespace sierra{
 namespace nalu{
 
 class Realm;
+class EdgeColoring;
 
 class AssembleMomentumEdgeSolverAlgorithm : public SolverAlgorithm
 {
@@ -25,7 +26,7 @@ public:
     Realm &realm,
     stk::mesh::Part *part,
     EquationSystem *eqSystem);
-  virtual ~AssembleMomentumEdgeSolverAlgorithm() {}
+  virtual ~AssembleMomentumEdgeSolverAlgorithm();
   virtual void initialize_connectivity();
   virtual void execute();
   
@@ -45,6 +46,8 @@ public:
   ScalarFieldType *viscosity_;
   VectorFieldType *edgeAreaVec_;
   ScalarFieldType *massFlowRate_;
+
+  EdgeColoring *edgeColoring_;
 };
 
 } // namespace nalu
@@ -15,6 +15,7 @@
 namespace stk {
 namespace mesh {
 class Part;
+class Bucket;
 }
 }
 
@@ -40,6 +41,11 @@ public:
     const double &dqp,
     const double &small);
 
+  // bucket assembly specialized on the element topology
+  template<class AlgTraits>
+  void execute_bucket(
+    stk::mesh::Bucket & b);
+
   const double includeDivU_;
   const double meshMotion_;
 
@@ -50,6 +56,17 @@ public:
   ScalarFieldType *density_;
   ScalarFieldType *viscosity_;
   GenericFieldType *massFlowRate_;
+
+  // cached element geometry; NULL when not active
+  GenericFieldType *scsAreaVec_;
+  GenericFieldType *scsDndx_;
+
+  // advection options; refreshed each execute
+  double hybridFactor_;
+  double alpha_;
+  double alphaUpw_;
+  double hoUpwind_;
+  bool useLimiter_;
 };
 
 } // namespace nalu
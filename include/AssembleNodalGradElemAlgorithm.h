@@ -38,6 +38,7 @@ public:
   VectorFieldType *dqdx_;
   ScalarFieldType *dualNodalVolume_;
   VectorFieldType *coordinates_;
+  GenericFieldType *scsAreaVec_;
 
   const bool useShifted_;
 };
@@ -0,0 +1,59 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef AssembleSSTCouplingNodeSolverAlgorithm_h
+#define AssembleSSTCouplingNodeSolverAlgorithm_h
+
+#include<SolverAlgorithm.h>
+#include<FieldTypeDef.h>
+
+namespace stk {
+namespace mesh {
+class Part;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+class Realm;
+
+// off diagonal (tke/sdr) blocks of the coupled SST system; linearization of
+// the SST node sources with respect to the other unknown. The diagonal
+// blocks and all right hand sides come from the tke and sdr algorithms
+class AssembleSSTCouplingNodeSolverAlgorithm : public SolverAlgorithm
+{
+public:
+
+  AssembleSSTCouplingNodeSolverAlgorithm(
+    Realm &realm,
+    stk::mesh::Part *part,
+    EquationSystem *eqSystem);
+  virtual ~AssembleSSTCouplingNodeSolverAlgorithm() {}
+  virtual void initialize_connectivity();
+  virtual void execute();
+
+  const double betaStar_;
+  const double gammaOne_;
+  const double gammaTwo_;
+  const double tkeProdLimitRatio_;
+  const int nDim_;
+
+  ScalarFieldType *tkeNp1_;
+  ScalarFieldType *sdrNp1_;
+  ScalarFieldType *densityNp1_;
+  ScalarFieldType *fOneBlend_;
+  ScalarFieldType *tvisc_;
+  GenericFieldType *dudx_;
+  ScalarFieldType *dualNodalVolume_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -15,6 +15,7 @@
 namespace stk {
 namespace mesh {
 class Part;
+class Bucket;
 }
 }
 
@@ -22,6 +23,7 @@ namespace sierra{
 namespace nalu{
 
 class Realm;
+class ElemGeometryBatch;
 
 class AssembleScalarElemSolverAlgorithm : public SolverAlgorithm
 {
@@ -43,6 +45,12 @@ public:
     const double &dqp,
     const double &small);
 
+  // bucket assembly specialized on the element topology
+  template<class AlgTraits>
+  void execute_bucket(
+    stk::mesh::Bucket & b,
+    ElemGeometryBatch & batch);
+
   const bool meshMotion_;
   
   ScalarFieldType *scalarQ_;
@@ -53,6 +61,17 @@ public:
   ScalarFieldType *density_;
   GenericFieldType *massFlowRate_;
 
+  // cached element geometry; NULL when not active
+  GenericFieldType *scsAreaVec_;
+  GenericFieldType *scsDndx_;
+
+  // advection options; refreshed each execute
+  double hybridFactor_;
+  double alpha_;
+  double alphaUpw_;
+  double hoUpwind_;
+  bool useLimiter_;
+
 };
 
 } // namespace nalu
@@ -0,0 +1,178 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef AsyncOutputManager_h
+#define AsyncOutputManager_h
+
+#include <stk_mesh/base/Entity.hpp>
+#include <stk_mesh/base/FieldState.hpp>
+#include <stk_mesh/base/Types.hpp>
+#include <stk_util/util/ParameterList.hpp>
+
+#include <pthread.h>
+
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+// stk
+namespace stk {
+namespace io {
+class StkMeshIoBroker;
+}
+namespace mesh {
+class BulkData;
+class FieldBase;
+class MetaData;
+}
+}
+
+// ioss
+namespace Ioss {
+class GroupingEntity;
+class Region;
+}
+
+namespace sierra{
+namespace nalu{
+
+// results and restart output written from a background thread. At an output
+// step the output fields are copied, on the calling thread, into rank local
+// buffers laid out as the database entities expect them; the database write
+// then overlaps the following time steps. At most one write is in flight.
+//
+// While a write is in flight the write thread touches only those buffers and
+// the Ioss::Region of the databases being written; it never enters the
+// BulkData or the io broker. The calling thread in turn must not touch the
+// io broker for a database registered here other than through this class,
+// which refuses to stage while a write is in flight. wait() is the barrier
+// taken at the next output step, ahead of any mesh modification and at
+// shutdown.
+//
+// The first write to each database defines it, which may be collective, so
+// it goes through stk_io on the calling thread. Later steps of a file per
+// processor database are local writes; serialized io is not supported
+class AsyncOutputManager
+{
+public:
+
+  AsyncOutputManager(
+    stk::io::StkMeshIoBroker &ioBroker,
+    stk::mesh::MetaData &metaData,
+    stk::mesh::BulkData &bulkData);
+  ~AsyncOutputManager();
+
+  // adds theField to the database under ioName; a restart database carries
+  // the old states as well, under the names stk_io gives them
+  void add_field(
+    const size_t fileIndex,
+    stk::mesh::FieldBase *theField,
+    const std::string &ioName,
+    const bool allStates);
+
+  // suffix of an old state in a restart database: N, NM1, ...
+  static std::string state_suffix(
+    const stk::mesh::FieldState state);
+
+  // block until the write in flight, if any, is complete
+  void wait();
+
+  // snapshot the fields for a write at the next launch; the defining write
+  // of a database is done in place
+  void stage_results(
+    const size_t fileIndex,
+    const double currentTime);
+
+  void stage_restart(
+    const size_t fileIndex,
+    const double currentTime,
+    const std::vector<std::pair<std::string, stk::util::Parameter> > &globals);
+
+  // write whatever has been staged
+  void launch();
+
+private:
+
+  struct OutputField {
+    stk::mesh::FieldBase *field_;
+    std::string ioName_;
+  };
+
+  // database entity and the mesh entities behind it, in database order
+  struct OutputEntities {
+    Ioss::GroupingEntity *ioEntity_;
+    stk::mesh::EntityRank rank_;
+    std::vector<stk::mesh::Entity> entities_;
+  };
+
+  struct EntityCache {
+    size_t syncCount_;
+    std::vector<OutputEntities> blocks_;
+  };
+
+  // copies of the mesh data, owned by the write
+  struct FieldBuffer {
+    Ioss::GroupingEntity *ioEntity_;
+    std::string ioName_;
+    std::vector<double> values_;
+  };
+
+  struct GlobalBuffer {
+    std::string name_;
+    std::vector<double> doubles_;
+    std::vector<int> ints_;
+  };
+
+  struct StagedWrite {
+    Ioss::Region *region_;
+    double time_;
+    std::vector<FieldBuffer> fields_;
+    std::vector<GlobalBuffer> globals_;
+  };
+
+  const std::vector<OutputEntities> &output_entities(
+    const size_t fileIndex);
+
+  void stage_fields(
+    const size_t fileIndex,
+    StagedWrite &write);
+
+  void stage_globals(
+    const std::vector<std::pair<std::string, stk::util::Parameter> > &globals,
+    StagedWrite &write);
+
+  // thread entry point
+  static void *execute_write(void *manager);
+  void write_staged();
+
+  stk::io::StkMeshIoBroker &ioBroker_;
+  stk::mesh::MetaData &metaData_;
+  stk::mesh::BulkData &bulkData_;
+
+  // fields written to each database, all states included
+  std::map<size_t, std::vector<OutputField> > outputFields_;
+
+  // databases that have seen their first, defining, write
+  std::set<size_t> definedFiles_;
+
+  // rebuilt after mesh modification
+  std::map<size_t, EntityCache> entityCache_;
+
+  pthread_t thread_;
+  bool writeInFlight_;
+  std::string writeError_;
+
+  std::vector<StagedWrite> staged_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -0,0 +1,124 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef ComponentLinearSystem_h
+#define ComponentLinearSystem_h
+
+#include <LinearSystem.h>
+
+#include <vector>
+#include <string>
+
+namespace sierra{
+namespace nalu{
+
+class Realm;
+
+// scalar view of one component of a coupled, multi dof, linear system (e.g.,
+// tke and sdr of SST); the algorithms of a scalar equation system assemble
+// through the view as usual. The owner of the coupled system zeros, loads
+// and solves it; views only forward graph requests, sums and dirichlet rows
+class ComponentLinearSystem : public LinearSystem
+{
+public:
+
+  ComponentLinearSystem(
+    Realm &realm,
+    LinearSystem *coupledSystem,
+    const unsigned component,
+    const std::string & name);
+  ~ComponentLinearSystem();
+
+  // Graph/Matrix Construction
+  void buildNodeGraph(const stk::mesh::PartVector & parts);
+  void buildFaceToNodeGraph(const stk::mesh::PartVector & parts);
+  void buildEdgeToNodeGraph(const stk::mesh::PartVector & parts);
+  void buildElemToNodeGraph(const stk::mesh::PartVector & parts);
+  void buildReducedElemToNodeGraph(const stk::mesh::PartVector & parts);
+  void buildFaceElemToNodeGraph(const stk::mesh::PartVector & parts);
+  void buildEdgeHaloNodeGraph(const stk::mesh::PartVector & parts);
+  void buildNonConformalNodeGraph(const stk::mesh::PartVector & parts);
+
+  // views are finalized in component order; the last one finalizes
+  // the coupled system once all graph requests are in
+  void finalizeLinearSystem();
+
+  // Matrix Assembly
+  void zeroSystem();
+
+  void sumInto(
+    const std::vector<stk::mesh::Entity> & entities,
+    const std::vector<double> & rhs,
+    const std::vector<double> & lhs,
+    const char *trace_tag=0
+    );
+
+  void sumInto(
+    AssemblyScratch & scratch,
+    const std::vector<stk::mesh::Entity> & entities,
+    const std::vector<double> & rhs,
+    const std::vector<double> & lhs,
+    const char *trace_tag=0
+    );
+
+  void sumIntoBatch(
+    AssemblyScratch & scratch,
+    const size_t numEntities,
+    const std::vector<stk::mesh::Entity> & entities,
+    const std::vector<double> & rhs,
+    const std::vector<double> & lhs,
+    const char *trace_tag=0
+    );
+
+  void applyDirichletBCs(
+    stk::mesh::FieldBase * solutionField,
+    stk::mesh::FieldBase * bcValuesField,
+    const stk::mesh::PartVector & parts,
+    const unsigned beginPos,
+    const unsigned endPos);
+
+  // Solve
+  int solve(stk::mesh::FieldBase * linearSolutionField);
+  void loadComplete();
+
+  void writeToFile(const char * filename, bool useOwned=true);
+  void writeSolutionToFile(const char * filename, bool useOwned=true);
+
+  LinearSystem * coupledSystem() { return coupledSystem_; }
+
+private:
+
+  void beginLinearSystemConstruction();
+  void checkError(
+    const int err_code,
+    const char * msg);
+
+  // expanded contributions; one per thread
+  struct ExpandedContribution {
+    std::vector<double> rhs_;
+    std::vector<double> lhs_;
+  };
+
+  // scalar contributions of numEntities entities placed in the rows and
+  // columns of this component of the coupled layout
+  ExpandedContribution & expand(
+    const size_t numEntities,
+    const size_t n_obj,
+    const std::vector<double> & rhs,
+    const std::vector<double> & lhs);
+
+  LinearSystem *coupledSystem_;
+  const unsigned component_;
+
+  std::vector<ExpandedContribution> expanded_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -47,6 +47,10 @@ public:
 
   const bool shiftMdot_;
   const bool shiftPoisson_;
+
+  // cached element geometry; NULL when not active
+  GenericFieldType *scsAreaVec_;
+  GenericFieldType *scsDndx_;
 };
 
 } // namespace nalu
@@ -30,6 +30,10 @@ class ConstantPropertyEvaluator : public PropertyEvaluator
   double execute(double *indVarList,
                  stk::mesh::Entity node);
 
+  void execute_bucket(const stk::mesh::Bucket & b,
+                      const double *indVar,
+                      double *prop);
+
   double value_;
 
 };
@@ -0,0 +1,68 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef EdgeColoring_h
+#define EdgeColoring_h
+
+#include <stk_mesh/base/Types.hpp>
+
+#include <vector>
+#include <cstddef>
+
+namespace sierra{
+namespace nalu{
+
+class Realm;
+
+class EdgeColoring
+{
+public:
+
+  // an edge by its bucket (index into buckets()) and its bucket ordinal;
+  // edge field data is then fetched once per bucket
+  struct EdgeOrdinal {
+    unsigned bucket_;
+    unsigned ordinal_;
+  };
+
+  EdgeColoring(
+    Realm &realm,
+    const stk::mesh::PartVector &partVec);
+  ~EdgeColoring() {}
+
+  // rebuild the colors should the mesh have changed since the last build
+  void update();
+
+  size_t num_colors() const { return colors_.size(); }
+  const std::vector<EdgeOrdinal> &edges(const size_t color) const { return colors_[color]; }
+
+  // locally owned edge buckets of the parts; valid until the next update
+  const stk::mesh::BucketVector &buckets() const { return buckets_; }
+
+private:
+
+  void build_colors();
+  void build_single_color();
+
+  Realm &realm_;
+  const stk::mesh::PartVector partVec_;
+
+  stk::mesh::BucketVector buckets_;
+
+  // locally owned edges; no two edges within a color share a (nalu) node
+  std::vector<std::vector<EdgeOrdinal> > colors_;
+
+  // mesh modification counter at the time of the last build
+  size_t syncCount_;
+  bool threaded_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
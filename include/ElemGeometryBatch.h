@@ -0,0 +1,85 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef ElemGeometryBatch_h
+#define ElemGeometryBatch_h
+
+#include <FieldTypeDef.h>
+
+#include <stk_topology/topology.hpp>
+
+#include <vector>
+#include <cstddef>
+
+namespace stk {
+namespace mesh {
+class Bucket;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+class MasterElement;
+
+class ElemGeometryBatch
+{
+public:
+
+  ElemGeometryBatch(
+    const int nDim);
+  ~ElemGeometryBatch() {}
+
+  // gather nodal coordinates for elements [offset, offset+numElem) of a
+  // bucket into the workset layout, coords(nDim, nodesPerElement, numElem)
+  void gather(
+    const stk::mesh::Bucket &b,
+    const size_t offset,
+    const size_t numElem,
+    const VectorFieldType &coordinates);
+
+  // one master element call for the full batch
+  void scs_determinant(MasterElement &meSCS);
+  void scs_grad_op(MasterElement &meSCS);
+  void scv_determinant(MasterElement &meSCV);
+
+  // scatter a single element to the layout of an nelem = 1 call
+  void scs_areav(const size_t e, double *areav) const;
+  void scs_dndx(const size_t e, double *dndx) const;
+  void scv_volume(const size_t e, double *volume) const;
+
+  size_t size() const { return numElem_; }
+  const double *coordinates(const size_t e) const {
+    return &ws_coordinates_[e*nodesPerElement_*nDim_]; }
+
+private:
+
+  const int nDim_;
+  stk::topology topo_;
+  size_t numElem_;
+  int nodesPerElement_;
+  int numScsIp_;
+  int numScvIp_;
+
+  // workset layouts follow the master element kernels:
+  //  areav(nDim, numElem, numScsIp), dndx(nDim, npe, numElem, numScsIp),
+  //  volume(numElem, numScvIp)
+  std::vector<double> ws_coordinates_;
+  std::vector<double> ws_scs_areav_;
+  std::vector<double> ws_dndx_;
+  std::vector<double> ws_deriv_;
+  std::vector<double> ws_det_j_;
+  std::vector<double> ws_scv_volume_;
+  std::vector<double> ws_error_;
+  std::vector<double> ws_points_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
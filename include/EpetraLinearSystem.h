@@ -58,6 +58,23 @@ public:
     const char *trace_tag=0
     );
 
+  void sumInto(
+    AssemblyScratch & scratch,
+    const std::vector<stk::mesh::Entity> & sym_meshobj,
+    const std::vector<double> & rhs,
+    const std::vector<double> & lhs,
+    const char *trace_tag=0
+    );
+
+  void sumIntoBatch(
+    AssemblyScratch & scratch,
+    const size_t numEntities,
+    const std::vector<stk::mesh::Entity> & sym_meshobj,
+    const std::vector<double> & rhs,
+    const std::vector<double> & lhs,
+    const char *trace_tag=0
+    );
+
   void dump_lhs(const std::string& msg);
   void applyDirichletBCs(
     stk::mesh::FieldBase * solutionField,
@@ -74,6 +91,15 @@ public:
 
 private:
   void beginLinearSystemConstruction();
+
+  // scatter one entity's rhs/lhs block; sumInto and sumIntoBatch land here
+  void sumIntoEntity(
+    AssemblyScratch & scratch,
+    const stk::mesh::Entity * entities,
+    const size_t n_obj,
+    const double * rhs,
+    const double * lhs);
+
   void checkError(
     const int err_code,
     const char * msg);
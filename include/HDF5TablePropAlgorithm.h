@@ -63,12 +63,24 @@ public:
   const size_t indVarSize_;
 
   std::vector<stk::mesh::FieldBase *> indVar_;
-  std::vector<double *> workIndVar_;
-  std::vector<double> workZ_;
+  std::vector<const double *> workIndVar_;
 
   /** execute Algorithm */
   virtual void execute();
 
+  /** True if this algorithm takes the given independent variables over part */
+  bool same_inputs(
+    stk::mesh::Part * part,
+    const std::vector<std::string> &indVarNameVec,
+    const std::vector<std::string> &indVarTableNameVec) const;
+
+  /** Evaluate another property of the same inputs in this algorithm.  When
+   *  every table shares one mesh, a single pass over the nodes computes
+   *  the basis functions once for all of them. */
+  void add_property(
+    stk::mesh::FieldBase * prop,
+    std::string tablePropName);
+
   /** Get the name of the variable returned by a query to this HDF5TablePropAlgorithm */
   const std::string & name() const { return tablePropName_; }
 
@@ -87,6 +99,16 @@ public:
   //HDF5 table holding for tablePropName_
   HDF5Table *table_;
 
+  // names of the independent fields
+  std::vector<std::string> indVarNameVec_;
+
+  // every property evaluated here; the first is prop_ from table_
+  std::vector<stk::mesh::FieldBase *> props_;
+  std::vector<const HDF5Table *> tables_;
+
+  // all tables share the lookup of table_
+  bool fused_;
+
   // Names of the inputs required by the query() function
   std::vector<std::string> inputNames_;
 
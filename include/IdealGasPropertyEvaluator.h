@@ -38,6 +38,11 @@ public:
   double execute(
     double *indVarList,
     stk::mesh::Entity node);
+
+  void execute_bucket(
+      const stk::mesh::Bucket & b,
+      const double *indVar,
+      double *prop);
   
   const double pRef_;
   const double R_;
@@ -59,6 +64,11 @@ public:
   double execute(
       double *indVarList,
       stk::mesh::Entity node);
+
+  void execute_bucket(
+      const stk::mesh::Bucket & b,
+      const double *indVar,
+      double *prop);
   
   double compute_mw(
       const double *yk);
@@ -90,6 +100,11 @@ public:
       double *indVarList,
       stk::mesh::Entity node);
 
+  void execute_bucket(
+      const stk::mesh::Bucket & b,
+      const double *indVar,
+      double *prop);
+
   // reference quantities
   const double R_;
 
@@ -116,6 +131,11 @@ public:
   double execute(
       double *indVarList,
       stk::mesh::Entity node);
+
+  void execute_bucket(
+      const stk::mesh::Bucket & b,
+      const double *indVar,
+      double *prop);
   
   double compute_mw(
       const double *yk);
@@ -44,6 +44,10 @@ typedef Teuchos::ScalarTraits<Scalar> STS;
 
 #include <MueLu_UseShortNames.hpp>    // => typedef MueLu::FooClass<Scalar, LocalOrdinal, ...> Foo
 
+#include <map>
+#include <set>
+#include <vector>
+
 class Epetra_FECrsMatrix;
 class Epetra_Vector;
 class Epetra_FEVector;
@@ -67,7 +71,8 @@ class LinearSolver
   public:
   LinearSolver(std::string name, LinearSolvers *linearSolvers,
     bool recompute_preconditioner, bool reuse_preconditioner) : name_(name), linearSolvers_(linearSolvers),
-    recomputePreconditioner_(recompute_preconditioner), reusePreconditioner_(reuse_preconditioner) {}
+    recomputePreconditioner_(recompute_preconditioner), reusePreconditioner_(reuse_preconditioner),
+    operatorKey_(-1), timerPrecond_(0.0) {}
   virtual ~LinearSolver() {}
   std::string name_;
   virtual PetraType getType() = 0;
@@ -77,9 +82,16 @@ class LinearSolver
   protected:
   bool recomputePreconditioner_;
   bool reusePreconditioner_;
+  // identifies which of several recurring operators (e.g., RTE ordinate)
+  // is being solved; data derived from the operator is cached by it; -1: none
+  int operatorKey_;
+  // time spent in preconditioner setup; reset by the owner when reported
+  double timerPrecond_;
   public:
   bool & recomputePreconditioner() {return recomputePreconditioner_;}
   bool & reusePreconditioner() {return reusePreconditioner_;}
+  int & operatorKey() {return operatorKey_;}
+  double & timerPrecond() {return timerPrecond_;}
 };
 
 class EpetraLinearSolver : public LinearSolver
@@ -158,16 +170,25 @@ class TpetraLinearSolver : public LinearSolver
       Teuchos::RCP<LinSys::Vector> rhs,
       Teuchos::RCP<LinSys::MultiVector> coords);
 
+    // block (BSR) storage; relaxation preconditioners only
+    void setupLinearSolver(
+      Teuchos::RCP<LinSys::Vector> sln,
+      Teuchos::RCP<LinSys::BlockMatrix> blockMatrix,
+      Teuchos::RCP<LinSys::Vector> rhs);
+
     void destroyLinearSolver();
 
     void setMueLu();
 
     int residual_norm(int whichNorm, Teuchos::RCP<LinSys::Vector> sln, double& norm);
 
+    // updatePreconditioner = false reuses the preconditioner of the
+    // previous solve; the matrix must not have changed in between
     int solve(
       Teuchos::RCP<LinSys::Vector> sln,
       int & iterationCount,
-      double & scaledResidual);
+      double & scaledResidual,
+      const bool updatePreconditioner = true);
 
     virtual PetraType getType() { return PT_TPETRA; }
     TpetraLinearSolverConfig *getConfig() { return config_; }
@@ -175,10 +196,36 @@ class TpetraLinearSolver : public LinearSolver
     bool & activeMueLu(){ return activateMueLu_; }
 
   private:
+    void createSolver();
+
+    // setup (MueLu or Ifpack2) for the current matrix values
+    void compute_preconditioner();
+
+    // adaptive reuse; the previous setup is kept for as long as neither the
+    // iteration count nor the matrix has drifted beyond the configured limits
+    bool preconditioner_is_stale();
+
+    // direct solve of a (locally) triangular operator, e.g., the upwind RTE;
+    // false when no sweep ordering exists on some rank, or the lagged
+    // parallel sweep does not converge, and a Krylov solve is required
+    bool sweep(
+      Teuchos::RCP<LinSys::Vector> sln,
+      int & iterationCount,
+      double & scaledResidual);
+
+    bool sweep_order(
+      const std::vector<LinSys::LocalOrdinal> &colToRow,
+      std::vector<LinSys::LocalOrdinal> &order);
+
+    bool sweep_order_is_valid(
+      const std::vector<LinSys::LocalOrdinal> &colToRow,
+      const std::vector<LinSys::LocalOrdinal> &order);
+
     TpetraLinearSolverConfig *config_;
     const Teuchos::RCP<Teuchos::ParameterList> params_;
     const Teuchos::RCP<Teuchos::ParameterList> paramsPrecond_;
     Teuchos::RCP<LinSys::Matrix> matrix_;
+    Teuchos::RCP<LinSys::BlockMatrix> blockMatrix_;
     Teuchos::RCP<LinSys::Vector> rhs_;
     Teuchos::RCP<LinSys::LinearProblem> problem_;
     Teuchos::RCP<LinSys::SolverManager> solver_;
@@ -188,6 +235,19 @@ class TpetraLinearSolver : public LinearSolver
 
     bool activateMueLu_;
 
+    // topological row orderings for the sweep, by operator key; valid for
+    // as long as the graph is (static mesh), rebuilt when found inconsistent
+    std::map<int, std::vector<LinSys::LocalOrdinal> > sweepOrder_;
+
+    // operator keys without an ordering on some rank (cycle, zero diagonal)
+    std::set<int> noSweepOrder_;
+
+    // iterations of the first solve after the last setup (-1: none on
+    // this graph), of the last solve and the matrix values at the setup
+    int setupIterations_;
+    int lastIterations_;
+    std::vector<double> setupValues_;
+
 };
 
 } // namespace nalu
@@ -77,9 +77,15 @@ class TpetraLinearSolverConfig {
     bool getSummarizeMueluTimer() { return summarizeMueluTimer_; }
     bool use_MueLu() const {return useMueLu_;}
     std::string & muelu_xml_file() {return muelu_xml_file_;}
+    bool muelu_numeric_refresh() const {return mueluNumericRefresh_;}
     bool recomputePreconditioner() { return recomputePreconditioner_; }
     bool reusePreconditioner() { return reusePreconditioner_; }
     std::string get_method() {return method_;}
+    bool use_block_storage() const {return useBlockStorage_;}
+    bool use_sweep() const {return useSweep_;}
+    bool adaptive_reuse() const {return adaptiveReuse_;}
+    double reuse_matrix_change() const {return reuseMatrixChange_;}
+    double reuse_iteration_growth() const {return reuseIterationGrowth_;}
 
   private:
     std::string name_;
@@ -93,9 +99,24 @@ class TpetraLinearSolverConfig {
     std::string muelu_xml_file_;
     bool useMueLu_;
 
+    // keep the MueLu aggregates and transfers until the graph changes
+    bool mueluNumericRefresh_;
+
     bool recomputePreconditioner_;
     bool reusePreconditioner_;
 
+    // systems with more than one dof per node use block (BSR) storage
+    bool useBlockStorage_;
+
+    // direct sweep for triangular (upwind) operators; method is the fallback
+    bool useSweep_;
+
+    // preconditioner recomputed only when the relative matrix change, or
+    // the iteration growth, since the last setup exceeds these limits
+    bool adaptiveReuse_;
+    double reuseMatrixChange_;
+    double reuseIterationGrowth_;
+
 };
 
 } // namespace nalu
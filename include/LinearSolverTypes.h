@@ -11,6 +11,7 @@
 
 #include <Tpetra_CrsGraph.hpp>
 #include <Tpetra_CrsMatrix.hpp>
+#include <Tpetra_Experimental_BlockCrsMatrix.hpp>
 
 // Forward declare templates
 namespace Teuchos {
@@ -99,6 +100,8 @@ typedef Teuchos::ArrayRCP<Scalar >                                         OneDV
 typedef Teuchos::ArrayRCP<const Scalar >                                   ConstOneDVector;
 typedef Tpetra::Vector<Scalar,LocalOrdinal,GlobalOrdinal,Node>             Vector;
 typedef Tpetra::CrsMatrix<Scalar, LocalOrdinal, GlobalOrdinal, Node>       Matrix;
+typedef Matrix::local_matrix_type                                          LocalMatrix;
+typedef Tpetra::Experimental::BlockCrsMatrix<Scalar, LocalOrdinal, GlobalOrdinal, Node> BlockMatrix;
 typedef Tpetra::Operator<Scalar, LocalOrdinal, GlobalOrdinal, Node>        Operator;
 typedef Belos::MultiVecTraits<Scalar, MultiVector>                         MultiVectorTraits;
 typedef Belos::OperatorTraits<Scalar,MultiVector, Operator>                OperatorTraits;
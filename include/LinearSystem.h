@@ -17,6 +17,7 @@
 #include <Teuchos_GlobalMPISession.hpp>
 #include <Teuchos_oblackholestream.hpp>
 
+#include <algorithm>
 #include <vector>
 #include <string>
 
@@ -35,6 +36,41 @@ namespace nalu{
 class Realm;
 class LinearSolver;
 
+// assembly work space; owned by a single caller (thread) at a time so that
+// sumInto never shares state between concurrent callers
+struct AssemblyScratch
+{
+  std::vector<int> globalIds_;
+  std::vector<LinSys::LocalOrdinal> localIds_;
+  std::vector<LinSys::LocalOrdinal> blockIds_;
+  std::vector<double> values_;
+
+  // sumIntoBatch; rows in scatter order and the merged columns of one row
+  std::vector<size_t> batchOrder_;
+  std::vector<LinSys::LocalOrdinal> batchLocalCols_;
+  std::vector<int> batchGlobalCols_;
+};
+
+// compares batch positions by the row id held there
+template<typename Id>
+struct CompareBatchRows
+{
+  CompareBatchRows(const std::vector<Id> &ids) : ids_(ids) {}
+  bool operator()(const size_t a, const size_t b) const { return ids_[a] < ids_[b]; }
+  const std::vector<Id> &ids_;
+};
+
+// positions of ids in increasing id order, so that sumIntoBatch visits
+// all contributions to a row together
+template<typename Id>
+void order_batch_rows(const std::vector<Id> &ids, std::vector<size_t> &order)
+{
+  order.resize(ids.size());
+  for ( size_t k = 0; k < order.size(); ++k )
+    order[k] = k;
+  std::sort(order.begin(), order.end(), CompareBatchRows<Id>(ids));
+}
+
 class LinearSystem
 {
 public:
@@ -49,6 +85,9 @@ public:
 
   static LinearSystem *create(Realm& realm, const unsigned numDof, const std::string & name, LinearSolver *linearSolver);
 
+  // one scalar matrix shared by numComponents right hand sides (Tpetra only)
+  static LinearSystem *create_segregated(Realm& realm, const unsigned numComponents, const std::string & name, LinearSolver *linearSolver);
+
   // Graph/Matrix Construction
   virtual void buildNodeGraph(const stk::mesh::PartVector & parts)=0; // for nodal assembly (e.g., lumped mass and source)
   virtual void buildFaceToNodeGraph(const stk::mesh::PartVector & parts)=0; // face->node assembly
@@ -70,6 +109,44 @@ public:
     const char *trace_tag=0
     )=0;
 
+  // reentrant sumInto; all work space comes from the caller's scratch
+  virtual void sumInto(
+    AssemblyScratch & scratch,
+    const std::vector<stk::mesh::Entity> & sym_meshobj,
+    const std::vector<double> & rhs,
+    const std::vector<double> & lhs,
+    const char *trace_tag=0
+    )=0;
+
+  // batched sumInto for numEntities entities with the same number of nodes;
+  // sym_meshobj, rhs and lhs hold each entity's contribution back to back.
+  // Contributions are merged by row, one matrix sumInto per distinct row
+  virtual void sumIntoBatch(
+    AssemblyScratch & scratch,
+    const size_t numEntities,
+    const std::vector<stk::mesh::Entity> & sym_meshobj,
+    const std::vector<double> & rhs,
+    const std::vector<double> & lhs,
+    const char *trace_tag=0
+    )=0;
+
+  // as above with the calling thread's scratch
+  void sumIntoBatch(
+    const size_t numEntities,
+    const std::vector<stk::mesh::Entity> & sym_meshobj,
+    const std::vector<double> & rhs,
+    const std::vector<double> & lhs,
+    const char *trace_tag=0);
+
+  // sumInto for the nodes of a single edge or element; allows a precomputed
+  // scatter plan to be used when one is available for this entity
+  virtual void sumIntoPlanned(
+    stk::mesh::Entity entity,
+    const std::vector<stk::mesh::Entity> & sym_meshobj,
+    const std::vector<double> & rhs,
+    const std::vector<double> & lhs,
+    const char *trace_tag=0);
+
   virtual void applyDirichletBCs(
     stk::mesh::FieldBase * solutionField,
     stk::mesh::FieldBase * bcValuesField,
@@ -83,13 +160,17 @@ public:
 
   virtual void writeToFile(const char * filename, bool useOwned=true)=0;
   virtual void writeSolutionToFile(const char * filename, bool useOwned=true)=0;
-  const unsigned numDof() const { return numDof_; }
+  // dofs per node as seen by the assembly algorithms
+  virtual const unsigned numDof() const { return numDof_; }
   const int & linearSolveIterations() {return linearSolveIterations_; }
   const double & linearResidual() {return linearResidual_; }
   const double & nonLinearResidual() {return nonLinearResidual_; }
   const double & scaledNonLinearResidual() {return scaledNonLinearResidual_; }
   bool & recomputePreconditioner() {return recomputePreconditioner_;}
   bool & reusePreconditioner() {return reusePreconditioner_;}
+  LinearSolver * linearSolver() {return linearSolver_;}
+  // multi dof system that this system is a component view of; NULL when stand alone
+  virtual LinearSystem * coupledSystem() {return NULL;}
 protected:
   virtual void beginLinearSystemConstruction()=0;
   virtual void checkError(
@@ -99,6 +180,9 @@ protected:
   void sync_field(const stk::mesh::FieldBase *field);
   bool debug();
 
+  // scratch for the calling thread; used by the scratch-less sumInto
+  AssemblyScratch & thread_scratch();
+
   Realm &realm_;
   bool inConstruction_;
   int writeCounter_;
@@ -114,6 +198,9 @@ protected:
   bool recomputePreconditioner_;
   bool reusePreconditioner_;
 
+  // one per thread
+  std::vector<AssemblyScratch> threadScratch_;
+
 public:
   bool provideOutput_;
 
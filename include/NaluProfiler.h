@@ -0,0 +1,93 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef NaluProfiler_h
+#define NaluProfiler_h
+
+#include <stk_util/diag/Timer.hpp>
+
+#include <map>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class Part;
+typedef std::vector<Part*> PartVector;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+// profiling on top of the stk::diag timer tree; wall clock time and call
+// counts of every timer are reduced over ranks (min/max/avg) by the timer
+// table printed at the end of the run. When a trace file is requested each
+// profiled block is also recorded as a Chrome trace event and written, one
+// file per rank, at the end of the run
+class NaluProfiler
+{
+public:
+
+  static NaluProfiler &self();
+
+  void activate_trace(const std::string &traceFileName);
+  bool trace_active() const { return traceActive_; }
+
+  // wall clock seconds
+  void record(
+    const std::string &name,
+    const double start,
+    const double stop);
+
+  void write_trace(const int rank) const;
+
+  // timer of an algorithm instance, keyed by class and parts
+  static std::string timer_name(
+    const std::type_info &type,
+    const stk::mesh::PartVector &partVec);
+
+  // readable name of a dynamic type
+  static std::string class_name(const std::type_info &type);
+
+private:
+
+  NaluProfiler();
+
+  struct TraceEvent {
+    size_t nameId_;
+    double start_;
+    double duration_;
+  };
+
+  bool traceActive_;
+  std::string traceFileName_;
+  double traceOrigin_;
+  std::map<std::string, size_t> nameIds_;
+  std::vector<std::string> names_;
+  std::vector<TraceEvent> events_;
+};
+
+// stk::diag::TimeBlock that also feeds the trace
+class ProfileBlock
+{
+public:
+  explicit ProfileBlock(stk::diag::Timer &timer);
+  ~ProfileBlock();
+
+private:
+  stk::diag::Timer &timer_;
+  stk::diag::TimeBlock timeBlock_;
+  double start_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -0,0 +1,72 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef NodeReordering_h
+#define NodeReordering_h
+
+#include <stk_mesh/base/Entity.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace sierra{
+namespace nalu{
+
+class Realm;
+
+// renumbers the nalu global ids so that the owned nodes of each processor
+// form a contiguous range in the requested order. The linear systems number
+// their rows by nalu global id, so this ordering is that of the matrix rows
+// and of the solution vectors:
+//
+//   bucket  - stk bucket order; rows line up with the node field data
+//   rcm     - reverse Cuthill-McKee over the element connectivity; narrow
+//             bandwidth, less preconditioner fill
+//   hilbert - Hilbert curve through the node coordinates
+class NodeReordering
+{
+public:
+
+  explicit NodeReordering(Realm &realm);
+  ~NodeReordering() {}
+
+  // assign the ids and make them consistent on shared and aura nodes
+  void execute(const std::string &orderingType);
+
+private:
+
+  void rcm_order(
+    const std::vector<stk::mesh::Entity> &ownedNodes,
+    std::vector<stk::mesh::Entity> &orderedNodes);
+
+  void hilbert_order(
+    const std::vector<stk::mesh::Entity> &ownedNodes,
+    std::vector<stk::mesh::Entity> &orderedNodes);
+
+  // owned nodes sharing an element with node; indices into the owned node list
+  void node_neighbors(
+    stk::mesh::Entity node,
+    const size_t self,
+    std::vector<size_t> &stamp,
+    const size_t currentStamp,
+    std::vector<size_t> &neighbors) const;
+
+  // position along the Hilbert curve of a point on a 2^bits grid
+  static size_t hilbert_key(
+    unsigned *point,
+    const int nDim,
+    const int bits);
+
+  Realm &realm_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -69,18 +69,34 @@ class NonConformalInfo {
     const double expandBoxPercentage,
     const std::string &searchMethodName,
     const bool clipIsoParametricCoords,
-    const double searchTolerance);
+    const double searchTolerance,
+    const bool incrementalSearch);
 
   ~NonConformalInfo();
 
   void initialize();
   void construct_dgInfo_state();
   void find_possible_face_elements();
+  void reuse_previous_search();
   void set_best_x();
   void determine_elems_to_ghost();
   void complete_search();
   void provide_diagnosis();
 
+  double distance_to_face(
+    stk::mesh::Entity face,
+    const std::vector<double> &pointCoords,
+    std::vector<double> &isoParCoords,
+    MasterElement *&meFC);
+
+  void set_opposing_face(
+    DgInfo *dgInfo,
+    stk::mesh::Entity opposingFace,
+    MasterElement *meFC,
+    const std::vector<double> &opposingIsoParCoords,
+    const double nearestDistance,
+    const int opposingFaceIsGhosted);
+
   Realm &realm_;
   const std::string name_;
 
@@ -102,6 +118,9 @@ class NonConformalInfo {
   /* does the realm have mesh motion */
   const bool meshMotion_;
 
+  /* start from the previous search; global search only for points that moved off */
+  const bool incrementalSearch_;
+
   /* master element for homegeneous block search type; one topo per contactinfo */
   MasterElement *meSCS_;
 
@@ -118,6 +137,9 @@ class NonConformalInfo {
   /* save off product of search */
   std::vector<std::pair<theKey, theKey> > searchKeyPair_;
 
+  /* opposing face id of the previous search; keyed by (current face id, ip) */
+  std::map<std::pair<uint64_t, int>, uint64_t> previousOpposingFaceMap_;
+
 };
 
 } // end sierra namespace
@@ -19,6 +19,7 @@
 
 #include <vector>
 #include <map>
+#include <set>
 
 namespace sierra {
 namespace nalu {
@@ -47,22 +48,30 @@ class NonConformalManager {
   // constructor and destructor
   NonConformalManager(
     Realm & realm,
-    const bool ncAlgDetailedOutput );
+    const bool ncAlgDetailedOutput,
+    const bool ncAlgIncrementalSearch );
 
   ~NonConformalManager();
 
   void initialize();
   void manage_ghosting();
+  void manage_ghosting_by_delta();
 
   Realm &realm_;
   const bool ncAlgDetailedOutput_;
 
+  /* ghosting is kept between searches and changed by delta */
+  const bool ncAlgIncrementalSearch_;
+
   /* ghosting for all surface:block pair */
   stk::mesh::Ghosting *nonConformalGhosting_;
 
   uint64_t needToGhostCount_;
  
   stk::mesh::EntityProcVec elemsToGhost_;
+
+  /* opposing faces, not locally owned, that some gauss point refers to */
+  std::set<uint64_t> requiredGhostFaces_;
   std::vector<NonConformalInfo *> nonConformalInfoVec_;
 
 };
@@ -63,6 +63,14 @@ class PeriodicManager {
     const bool &addSlaves = true,
     const bool &setSlaves = true);
 
+  // as above for a set of fields; each communication covers all fields
+  void apply_constraints(
+    const std::vector<stk::mesh::FieldBase *> &fields,
+    const std::vector<unsigned> &sizeOfFields,
+    const bool &bypassFieldCheck,
+    const bool &addSlaves = true,
+    const bool &setSlaves = true);
+
   // find the max
   void apply_max_field(
     stk::mesh::FieldBase *,
@@ -105,11 +113,22 @@ class PeriodicManager {
   periodic_parallel_communicate_field(
     stk::mesh::FieldBase *theField);
 
+  void
+  periodic_parallel_communicate_fields(
+    const std::vector<const stk::mesh::FieldBase *> &fieldVec);
+
   /* communicate shared nodes and aura nodes */
   void
   parallel_communicate_field(
     stk::mesh::FieldBase *theField);
 
+  void
+  parallel_communicate_fields(
+    const std::vector<const stk::mesh::FieldBase *> &fieldVec);
+
+  /* bucket and ordinal of every master and slave node */
+  void update_pair_plan();
+
   Realm &realm_;
   double searchTolerance_;
 
@@ -141,12 +160,25 @@ class PeriodicManager {
   // culmination of all searches
   SearchKeyVector searchKeyVector_;
 
-  void add_slave_to_master(
-    stk::mesh::FieldBase *theField,
-    const unsigned &sizeOfField,
-    const bool &bypassFieldCheck);
-
-  void set_slave_to_master(
+  // flat master/slave plan, ordered by master bucket; a field is then
+  // addressed with one field_data call per bucket rather than per node
+  struct NodeLocation {
+    const stk::mesh::Bucket *bucket_;
+    unsigned ordinal_;
+  };
+  std::vector<NodeLocation> masterLocations_;
+  std::vector<NodeLocation> slaveLocations_;
+  size_t planSyncCount_;
+
+  enum PairOperation {
+    ADD_SLAVE_TO_MASTER = 0,
+    SET_SLAVE_TO_MASTER,
+    MAX_OF_PAIR
+  };
+
+  // apply op to every master/slave pair of theField
+  void apply_pair_operation(
+    const PairOperation op,
     stk::mesh::FieldBase *theField,
     const unsigned &sizeOfField,
     const bool &bypassFieldCheck);
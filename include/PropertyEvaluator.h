@@ -10,6 +10,7 @@
 #define PropertyEvaluator_h
 
 #include <stk_mesh/base/Entity.hpp>
+#include <stk_mesh/base/Bucket.hpp>
 
 #include <vector>
 
@@ -26,7 +27,25 @@ public:
   virtual double execute(
     double *indVarList,
     stk::mesh::Entity node = stk::mesh::Entity()) = 0;
-  
+
+  // evaluate every node of a bucket in one call; indVar holds the single
+  // independent variable (temperature) per node, or is NULL for evaluators
+  // that take none. Evaluators override this with loops over contiguous
+  // field data; the default falls back to execute() node by node
+  virtual void execute_bucket(
+    const stk::mesh::Bucket & b,
+    const double *indVar,
+    double *prop)
+  {
+    double indVarList[1] = {0.0};
+    const stk::mesh::Bucket::size_type length = b.size();
+    for ( stk::mesh::Bucket::size_type k = 0; k < length; ++k ) {
+      if ( NULL != indVar )
+        indVarList[0] = indVar[k];
+      prop[k] = execute(indVarList, b[k]);
+    }
+  }
+
 };
 
 } // namespace nalu
@@ -25,6 +25,7 @@
 
 // standard c++
 #include <map>
+#include <set>
 #include <string>
 #include <vector>
 #include <stdint.h>
@@ -47,6 +48,7 @@ namespace nalu{
 
 class Algorithm;
 class AlgorithmDriver;
+class AsyncOutputManager;
 class AuxFunctionAlgorithm;
 class ComputeGeometryAlgorithmDriver;
 class ContactInfo;
@@ -65,6 +67,7 @@ class Realms;
 class Simulation;
 class SolutionOptions;
 class TimeIntegrator;
+class TpetraGraphCache;
 class MasterElement;
 class PropertyEvaluator;
 class HDF5FilePtr;
@@ -122,6 +125,7 @@ public:
 
   void initialize_global_variables();
 
+  void setup_async_output();
   void create_output_mesh();
   void create_restart_mesh();
   void input_variables_from_mesh();
@@ -219,6 +223,12 @@ public:
     const unsigned &sizeOfTheField,
     const bool &bypassFieldCheck = true) const;
 
+  // one set of periodic/parallel communications for all fields
+  void periodic_field_update(
+    const std::vector<stk::mesh::FieldBase *> &fields,
+    const std::vector<unsigned> &sizeOfTheFields,
+    const bool &bypassFieldCheck = true) const;
+
   void periodic_delta_solution_update(
      stk::mesh::FieldBase *theField,
      const unsigned &sizeOfTheField) const;
@@ -308,6 +318,9 @@ public:
 
   // get aura, bulk and meta data
   bool get_activate_aura();
+  bool get_activate_threaded_assembly();
+  bool has_geometry_cache();
+  TpetraGraphCache *tpetra_graph_cache();
   stk::mesh::BulkData & bulk_data();
   stk::mesh::MetaData & meta_data();
 
@@ -328,6 +341,9 @@ public:
   stk::mesh::BulkData *bulkData_;
   stk::io::StkMeshIoBroker *ioBroker_;
 
+  // non-null when output is overlapped with the time loop
+  AsyncOutputManager *asyncOutput_;
+
   size_t resultsFileIndex_;
   size_t restartFileIndex_;
 
@@ -427,6 +443,20 @@ public:
   // allow detailed output (memory) to be provided
   bool activateMemoryDiagnostic_;
 
+  // allow shared-memory threads within assembly
+  bool activateThreadedAssembly_;
+
+  // allow scs area vectors and dndx to be stored as element fields
+  bool activateGeometryCache_;
+
+  // allow linear systems to share finalized graphs; optionally stored on disk
+  bool activateGraphSharing_;
+  std::string graphCacheDirectory_;
+  TpetraGraphCache *tpetraGraphCache_;
+
+  // ordering of the nalu global ids (and linear system rows); none, bucket, rcm or hilbert
+  std::string nodeReorderingType_;
+
   // mesh parts for all boundary conditions
   stk::mesh::PartVector bcPartVec_;
 
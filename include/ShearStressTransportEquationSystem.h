@@ -33,7 +33,8 @@ class ShearStressTransportEquationSystem : public EquationSystem {
 public:
 
   ShearStressTransportEquationSystem(
-    EquationSystems& equationSystems);
+    EquationSystems& equationSystems,
+    const bool coupledSolve);
   virtual ~ShearStressTransportEquationSystem();
   
   virtual void initialize();
@@ -51,11 +52,18 @@ public:
 
   virtual void solve_and_update();
   void post_adapt_work();
+  virtual void reinitialize_linear_system();
 
   void clip_min_distance_to_wall();
   void compute_f_one_blending();
   void update_and_clip();
 
+  // tke and sdr as one 2-dof system; linsys_ is the coupled system and
+  // the tke/sdr systems assemble into it through component views
+  void create_component_systems();
+  void assemble_and_solve_coupled();
+  void split_coupled_solution();
+
   TurbKineticEnergyEquationSystem *tkeEqSys_;
   SpecificDissipationRateEquationSystem *sdrEqSys_;
 
@@ -64,8 +72,10 @@ public:
   ScalarFieldType *minDistanceToWall_;
   ScalarFieldType *fOneBlending_;
   ScalarFieldType *maxLengthScale_;
+  GenericFieldType *sstTmp_;
 
   bool isInit_;
+  const bool coupledSolve_;
   AlgorithmDriver *sstMaxLengthScaleAlgDriver_;
 
   // saved of mesh parts that are for wall bcs
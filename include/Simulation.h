@@ -44,6 +44,9 @@ public:
   static stk::diag::TimerSet &rootTimerSet();
   static stk::diag::Timer &rootTimer();
   static stk::diag::Timer &outputTimer();
+  static stk::diag::Timer &algorithmTimer();
+  static stk::diag::Timer &linearSolverTimer();
+  static stk::diag::Timer &communicationTimer();
 
   const YAML::Node& m_root_node;
   TimeIntegrator *timeIntegrator_;
@@ -41,6 +41,22 @@ protected:
     const std::vector<double> &rhs,
     const std::vector<double> &lhs,
     const char *trace_tag=0);
+
+  // as above, however, for the nodes of a single edge or element
+  void apply_coeff(
+    stk::mesh::Entity entity,
+    const std::vector<stk::mesh::Entity> & sym_meshobj,
+    const std::vector<double> &rhs,
+    const std::vector<double> &lhs,
+    const char *trace_tag=0);
+
+  // numEntities blocks of equal size, back to back; merged by row
+  void apply_coeff_batch(
+    const size_t numEntities,
+    const std::vector<stk::mesh::Entity> & sym_meshobj,
+    const std::vector<double> &rhs,
+    const std::vector<double> &lhs,
+    const char *trace_tag=0);
   
   EquationSystem *eqSystem_;
 };
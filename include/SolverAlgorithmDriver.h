@@ -13,6 +13,7 @@
 #include<Enums.h>
 
 #include<map>
+#include<string>
 
 namespace sierra{
 namespace nalu{
@@ -25,7 +26,8 @@ class SolverAlgorithmDriver : public AlgorithmDriver
 public:
 
   SolverAlgorithmDriver(
-    Realm &realm);
+    Realm &realm,
+    const std::string &name = "");
   virtual ~SolverAlgorithmDriver();
 
   virtual void initialize_connectivity();
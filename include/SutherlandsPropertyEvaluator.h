@@ -40,6 +40,11 @@ public:
   double execute(
       double *indVarList,
       stk::mesh::Entity node);
+
+  void execute_bucket(
+      const stk::mesh::Bucket & b,
+      const double *indVar,
+      double *prop);
   
   double compute_viscosity(
       const double &T,
@@ -64,6 +69,11 @@ public:
       double *indVarList,
       stk::mesh::Entity node);
 
+  void execute_bucket(
+      const stk::mesh::Bucket & b,
+      const double *indVar,
+      double *prop);
+
   virtual double compute_viscosity(
       const double &T,
       const double *pt_poly);
@@ -92,6 +102,11 @@ public:
       double *indVarList,
       stk::mesh::Entity node);
 
+  void execute_bucket(
+      const stk::mesh::Bucket & b,
+      const double *indVar,
+      double *prop);
+
   const double tRef_;
 };
 
@@ -0,0 +1,111 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef TpetraGraphCache_h
+#define TpetraGraphCache_h
+
+#include <LinearSolverTypes.h>
+
+#include <Teuchos_RCP.hpp>
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace sierra{
+namespace nalu{
+
+// finalized maps and graphs of a TpetraLinearSystem; matrices of any
+// system with the same connectivity and dof count may be built on them
+struct TpetraSharedGraph
+{
+  TpetraSharedGraph() : syncCount_(0) {}
+
+  size_t syncCount_;
+  std::vector<LinSys::GlobalOrdinal> totalGids_;
+  Teuchos::RCP<LinSys::Map> totalColsMap_;
+  Teuchos::RCP<LinSys::Map> ownedRowsMap_;
+  Teuchos::RCP<LinSys::Map> ownedPlusGloballyOwnedRowsMap_;
+  Teuchos::RCP<LinSys::Map> globallyOwnedRowsMap_;
+  Teuchos::RCP<LinSys::Graph> ownedGraph_;
+  Teuchos::RCP<LinSys::Graph> globallyOwnedGraph_;
+  Teuchos::RCP<LinSys::Export> exporter_;
+  Teuchos::RCP<LinSys::Import> importer_;
+};
+
+// rows of a graph in global ids; the form written to, and read from, disk
+struct TpetraGraphRows
+{
+  std::vector<LinSys::GlobalOrdinal> rows_;
+  std::vector<size_t> offsets_;
+  std::vector<LinSys::GlobalOrdinal> cols_;
+};
+
+class TpetraGraphCache
+{
+public:
+
+  TpetraGraphCache(
+    const std::string &directory);
+  ~TpetraGraphCache();
+
+  // in memory sharing; an entry is only valid within the mesh
+  // modification cycle (synchronized count) in which it was built
+  TpetraSharedGraph *find(
+    const std::string &key,
+    const size_t syncCount);
+
+  void insert(
+    const std::string &key,
+    const TpetraSharedGraph &graph);
+
+  // on disk persistence for restarts; one file per key and rank. The hash
+  // of the local connectivity and numbering is stored and checked on read
+  bool has_directory() const { return !directory_.empty(); }
+
+  bool read(
+    const std::string &key,
+    const int rank,
+    const int numProcs,
+    const size_t connectivityHash,
+    std::vector<LinSys::GlobalOrdinal> &totalGids,
+    TpetraGraphRows &globallyOwnedRows,
+    TpetraGraphRows &ownedRows) const;
+
+  bool write(
+    const std::string &key,
+    const int rank,
+    const int numProcs,
+    const size_t connectivityHash,
+    const std::vector<LinSys::GlobalOrdinal> &totalGids,
+    const TpetraGraphRows &globallyOwnedRows,
+    const TpetraGraphRows &ownedRows) const;
+
+  // conversion between a fill complete graph and its rows
+  static void extract_rows(
+    const LinSys::Graph &graph,
+    TpetraGraphRows &rows);
+
+  static void insert_rows(
+    const TpetraGraphRows &rows,
+    LinSys::Graph &graph);
+
+private:
+
+  std::string file_name(
+    const std::string &key,
+    const int rank) const;
+
+  const std::string directory_;
+  std::map<std::string, TpetraSharedGraph> graphs_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
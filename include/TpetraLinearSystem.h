@@ -10,6 +10,7 @@
 #define TpetraLinearSystem_h
 
 #include <LinearSystem.h>
+#include <TpetraGraphCache.h>
 
 #include <Tpetra_DefaultPlatform.hpp>
 #include <Kokkos_DefaultNode.hpp>
@@ -18,6 +19,7 @@
 #include <Tpetra_CrsMatrix.hpp>
 
 #include <stk_mesh/base/Entity.hpp>
+#include <stk_mesh/base/Types.hpp>
 
 #include <vector>
 #include <string>
@@ -71,6 +73,31 @@ public:
     const char *trace_tag=0
     );
 
+  void sumInto(
+    AssemblyScratch & scratch,
+    const std::vector<stk::mesh::Entity> & entities,
+    const std::vector<double> & rhs,
+    const std::vector<double> & lhs,
+    const char *trace_tag=0
+    );
+
+  void sumIntoBatch(
+    AssemblyScratch & scratch,
+    const size_t numEntities,
+    const std::vector<stk::mesh::Entity> & entities,
+    const std::vector<double> & rhs,
+    const std::vector<double> & lhs,
+    const char *trace_tag=0
+    );
+
+  void sumIntoPlanned(
+    stk::mesh::Entity entity,
+    const std::vector<stk::mesh::Entity> & entities,
+    const std::vector<double> & rhs,
+    const std::vector<double> & lhs,
+    const char *trace_tag=0
+    );
+
   void applyDirichletBCs(
     stk::mesh::FieldBase * solutionField,
     stk::mesh::FieldBase * bcValuesField,
@@ -84,7 +111,7 @@ public:
   void writeToFile(const char * filename, bool useOwned=true);
   void printInfo(bool useOwned=true);
   void writeSolutionToFile(const char * filename, bool useOwned=true);
-  size_t lookup_myLID(MyLIDMapType& myLIDs, stk::mesh::EntityId entityId, const std::string& msg="", stk::mesh::Entity entity = stk::mesh::Entity());
+  size_t lookup_myLID(const MyLIDMapType& myLIDs, stk::mesh::EntityId entityId, const std::string& msg="", stk::mesh::Entity entity = stk::mesh::Entity());
 
   enum DOFStatus {
     DS_NotSet           = 0,
@@ -96,8 +123,90 @@ public:
 
   int getDofStatus(stk::mesh::Entity node);
 
+protected:
+  // what a derived (e.g., segregated) system assembles into and solves with
+  void checkForNaN(bool useOwned);
+  bool checkForZeroRow(bool useOwned, bool doThrow, bool doPrint=false);
+
+  // Map of rows my proc owns (locally owned)
+  Teuchos::RCP<LinSys::Map>    ownedRowsMap_;
+
+  // Only nodes that share with other procs that I don't own = Global = !locally owned
+  Teuchos::RCP<LinSys::Map>    globallyOwnedRowsMap_;
+
+  Teuchos::RCP<LinSys::Matrix> ownedMatrix_;
+  Teuchos::RCP<LinSys::Vector> ownedRhs_;
+
+  Teuchos::RCP<LinSys::Matrix> globallyOwnedMatrix_;
+
+  Teuchos::RCP<LinSys::Vector> sln_;
+  Teuchos::RCP<LinSys::Export> exporter_;
+
+  MyLIDMapType myLIDs_;
+
+  // edge/element parts of the scatter plan; see buildAssemblyPlan
+  stk::mesh::PartVector edgePlanParts_;
+  stk::mesh::PartVector elemPlanParts_;
+
+  LocalOrdinal maxOwnedRowId_; // = num_owned_nodes * numDof_
+  LocalOrdinal maxGloballyOwnedRowId_; // = (num_owned_nodes + num_globallyOwned_nodes) * numDof_
+
 private:
   void beginLinearSystemConstruction();
+  void buildRowMaps();
+
+  // connectivity gathering for the build*Graph methods; deferred until
+  // finalize so that a shared (or stored) graph can skip it altogether
+  enum GraphRequestType {
+    GR_Node        = 0,
+    GR_FaceToNode  = 1,
+    GR_EdgeToNode  = 2,
+    GR_ElemToNode  = 3,
+    GR_ReducedElem = 4,
+    GR_FaceElem    = 5
+  };
+  void addGraphRequest(
+    const GraphRequestType type,
+    const stk::mesh::PartVector & parts);
+  void addNodeConnections(const stk::mesh::PartVector & parts);
+  void addFaceToNodeConnections(const stk::mesh::PartVector & parts);
+  void addEdgeToNodeConnections(const stk::mesh::PartVector & parts);
+  void addElemToNodeConnections(const stk::mesh::PartVector & parts);
+  void addReducedElemToNodeConnections(const stk::mesh::PartVector & parts);
+  void addFaceElemToNodeConnections(const stk::mesh::PartVector & parts);
+
+  // graph construction; from connections, a shared graph or a stored graph
+  std::string graphKey();
+  void buildGraph();
+  void adoptSharedGraph(const TpetraSharedGraph & shared);
+  TpetraSharedGraph shareGraph(const size_t syncCount);
+  size_t connectivityHash();
+  bool readGraph(const TpetraGraphCache & graphCache, const std::string & key, const size_t connHash);
+  void writeGraph(const TpetraGraphCache & graphCache, const std::string & key, const size_t connHash);
+
+  // scatter one entity's rhs/lhs block; sumInto and sumIntoBatch land here
+  void sumIntoEntity(
+    AssemblyScratch & scratch,
+    const stk::mesh::Entity * entities,
+    const size_t n_obj,
+    const double * rhs,
+    const double * lhs);
+
+  // block storage of the owned rows; one dense numDof_ x numDof_ block per
+  // node pair, while off-process rows remain in point form
+  void buildBlockMatrix();
+  void sumIntoBlockEntity(
+    AssemblyScratch & scratch,
+    const stk::mesh::Entity * entities,
+    const size_t n_obj,
+    const double * rhs,
+    const double * lhs);
+  void addImportedBlocks();
+
+  // owned or globally owned point matrix; a point copy of the owned block
+  // matrix under block storage (diagnostics and matrix files)
+  Teuchos::RCP<LinSys::Matrix> pointMatrix(bool useOwned);
+
   void checkError(
     const int err_code,
     const char * msg);
@@ -112,8 +221,15 @@ private:
     const Teuchos::RCP<LinSys::MultiVector> tpetraVector);
 
   void addConnections(const std::vector<stk::mesh::Entity> & entities);
-  void checkForNaN(bool useOwned);
-  bool checkForZeroRow(bool useOwned, bool doThrow, bool doPrint=false);
+
+  // scatter plan for edge/element assembly; built once the graph is final
+  void buildAssemblyPlan();
+  void addToAssemblyPlan(
+    const stk::mesh::PartVector & parts,
+    const stk::mesh::EntityRank rank);
+
+  // node local ids by bucket; rebuilt after any mesh modification
+  void update_bucket_lids();
 
   typedef std::pair<stk::mesh::Entity, stk::mesh::Entity> Connection;
   typedef std::set< Connection > ConnectionSet;
@@ -121,37 +237,67 @@ private:
   ConnectionSet connectionSet_;
   std::vector<GlobalOrdinal> totalGids_;
 
+  // build*Graph calls not yet turned into connections; the graph is only
+  // shareable when every connection follows from a request
+  std::vector<std::pair<GraphRequestType, stk::mesh::PartVector> > graphRequests_;
+  bool graphShareable_;
+
   Teuchos::RCP<LinSys::Node>   node_;
 
   // all rows, otherwise known as col map
   Teuchos::RCP<LinSys::Map>    totalColsMap_;
 
-  // Map of rows my proc owns (locally owned)
-  Teuchos::RCP<LinSys::Map>    ownedRowsMap_;
-
   // Map of all rows my proc references
   Teuchos::RCP<LinSys::Map>    ownedPlusGloballyOwnedRowsMap_;
 
-  // Only nodes that share with other procs that I don't own = Global = !locally owned
-  Teuchos::RCP<LinSys::Map>    globallyOwnedRowsMap_;
-
   Teuchos::RCP<LinSys::Graph>  ownedGraph_;
   Teuchos::RCP<LinSys::Graph>  globallyOwnedGraph_;
 
-  Teuchos::RCP<LinSys::Matrix> ownedMatrix_;
-  Teuchos::RCP<LinSys::Vector> ownedRhs_;
-
-  Teuchos::RCP<LinSys::Matrix> globallyOwnedMatrix_;
   Teuchos::RCP<LinSys::Vector> globallyOwnedRhs_;
 
-  Teuchos::RCP<LinSys::Vector> sln_;
+  // owned matrix in block form when the solver asks for it (numDof_ > 1)
+  bool useBlockStorage_;
+  Teuchos::RCP<LinSys::Map>         ownedNodeRowsMap_;
+  Teuchos::RCP<LinSys::Graph>       ownedBlockGraph_;
+  Teuchos::RCP<LinSys::BlockMatrix> ownedBlockMatrix_;
+
+  // point matrix on the export of the globally owned graph and, for each
+  // of its entries, the block column and column dof it is added to
+  Teuchos::RCP<LinSys::Matrix>      importedMatrix_;
+  std::vector<LocalOrdinal>         importedBlockCols_;
+  std::vector<int>                  importedBlockDofs_;
+
   Teuchos::RCP<LinSys::Vector> globalSln_;
-  Teuchos::RCP<LinSys::Export> exporter_;
   Teuchos::RCP<LinSys::Import> importer_;
 
-  MyLIDMapType myLIDs_;
-  LocalOrdinal maxOwnedRowId_; // = num_owned_nodes * numDof_
-  LocalOrdinal maxGloballyOwnedRowId_; // = (num_owned_nodes + num_globallyOwned_nodes) * numDof_
+  // precomputed scatter plan; for each planned edge/element, the first local
+  // row of each node and, for each lhs entry, its offset within the row of
+  // the static graph it is summed into. The values then go straight into
+  // the local matrix storage, with no column search
+  struct AssemblyPlanEntry {
+    stk::mesh::Entity entity_;
+    size_t rowBegin_;
+    size_t offsetBegin_;
+    unsigned numNodes_;
+  };
+  std::vector<int> planIndex_; // by entity local offset; -1 when not planned
+  std::vector<AssemblyPlanEntry> planEntries_;
+  std::vector<LocalOrdinal> planRows_;
+  std::vector<LocalOrdinal> planOffsets_;
+
+  // local storage of the point matrices; taken at zeroSystem
+  LinSys::LocalMatrix ownedLocalMatrix_;
+  LinSys::LocalMatrix globallyOwnedLocalMatrix_;
+
+  // local id of each node (row of its first dof over numDof_), by node bucket
+  // id and ordinal; -1 when not in myLIDs_. The local ids of a contiguous
+  // bucket form a run, so its field data maps onto one slice of a vector
+  struct BucketLIDs {
+    std::vector<LocalOrdinal> lids_;
+    bool contiguous_;
+  };
+  std::vector<BucketLIDs> bucketLIDs_;
+  size_t bucketLIDsSyncCount_;
 };
 
 
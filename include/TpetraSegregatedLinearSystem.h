@@ -0,0 +1,113 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef TpetraSegregatedLinearSystem_h
+#define TpetraSegregatedLinearSystem_h
+
+#include <TpetraLinearSystem.h>
+
+#include <vector>
+#include <string>
+
+namespace sierra{
+namespace nalu{
+
+class Realm;
+class LinearSolver;
+
+// segregated solve of an numComponents dof system (e.g., momentum); the
+// algorithms assemble the coupled system as usual, however, only the average
+// of the component diagonal blocks is stored, as one scalar matrix, while the
+// rhs keeps one column per component. The components are solved in turn
+// against the shared matrix with one solver and preconditioner. A Dirichlet
+// condition must therefore constrain all components of its nodes
+class TpetraSegregatedLinearSystem : public TpetraLinearSystem
+{
+public:
+
+  TpetraSegregatedLinearSystem(
+    Realm &realm,
+    const unsigned numComponents,
+    const std::string & name,
+    LinearSolver * linearSolver);
+  ~TpetraSegregatedLinearSystem();
+
+  const unsigned numDof() const { return numComponents_; }
+
+  void finalizeLinearSystem();
+
+  // Matrix Assembly
+  void zeroSystem();
+
+  void sumInto(
+    const std::vector<stk::mesh::Entity> & entities,
+    const std::vector<double> & rhs,
+    const std::vector<double> & lhs,
+    const char *trace_tag=0
+    );
+
+  void sumInto(
+    AssemblyScratch & scratch,
+    const std::vector<stk::mesh::Entity> & entities,
+    const std::vector<double> & rhs,
+    const std::vector<double> & lhs,
+    const char *trace_tag=0
+    );
+
+  void sumIntoBatch(
+    AssemblyScratch & scratch,
+    const size_t numEntities,
+    const std::vector<stk::mesh::Entity> & entities,
+    const std::vector<double> & rhs,
+    const std::vector<double> & lhs,
+    const char *trace_tag=0
+    );
+
+  void sumIntoPlanned(
+    stk::mesh::Entity entity,
+    const std::vector<stk::mesh::Entity> & entities,
+    const std::vector<double> & rhs,
+    const std::vector<double> & lhs,
+    const char *trace_tag=0
+    );
+
+  void applyDirichletBCs(
+    stk::mesh::FieldBase * solutionField,
+    stk::mesh::FieldBase * bcValuesField,
+    const stk::mesh::PartVector & parts,
+    const unsigned beginPos,
+    const unsigned endPos);
+
+  // Solve
+  int solve(stk::mesh::FieldBase * linearSolutionField);
+  void loadComplete();
+
+private:
+
+  void sumIntoSegregatedEntity(
+    AssemblyScratch & scratch,
+    const stk::mesh::Entity * entities,
+    const size_t n_obj,
+    const double * rhs,
+    const double * lhs);
+
+  void copy_components_to_stk(
+    stk::mesh::FieldBase * stkField);
+
+  const unsigned numComponents_;
+
+  // one column per component
+  Teuchos::RCP<LinSys::MultiVector> ownedRhsComponents_;
+  Teuchos::RCP<LinSys::MultiVector> globallyOwnedRhsComponents_;
+  Teuchos::RCP<LinSys::MultiVector> slnComponents_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -35,7 +35,8 @@ public:
       const int quadratureOrder,
       const bool activateScattering,
       const bool activateUpwind,
-      const bool externalCoupling);
+      const bool externalCoupling,
+      const int ordinateGroupSize);
   virtual ~RadiativeTransportEquationSystem();
   
   void register_nodal_fields(
@@ -106,6 +107,9 @@ public:
   const bool activateScattering_;
   const bool activateUpwind_;
   const bool externalCoupling_;
+
+  // ordinates of an octant that share one preconditioner setup
+  const int ordinateGroupSize_;
   
   ScalarFieldType *intensity_;
   ScalarFieldType *currentIntensity_;
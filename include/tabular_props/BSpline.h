@@ -8,6 +8,7 @@ namespace nalu {
 
 // Forward declarations
 class H5IO;
+class BSpline1D;
 
 //====================================================================
 //====================================================================
@@ -55,6 +56,67 @@ class BSpline{
 
   double value( std::vector<double> & x ) const{ return value( &x[0] ); }
 
+  /** Limits on the size of the basis function arrays below */
+  static const int maxDimension = 5;
+  static const int maxBasis = 11;
+
+  /**
+   *  Evaluate the dependent variable at a point without touching any
+   *  member scratch, so concurrent calls are safe.  span holds one knot
+   *  span per dimension: on input a guess (or -1 for none), on output
+   *  the spans that contain this point.
+   */
+  double span_value( const double* x, int* span ) const;
+
+  /**
+   *  Evaluate the dependent variable at npts points given as one array
+   *  per independent variable, x[d][i].  The knot spans of each point
+   *  seed the search for the next, which is nearly free for the smoothly
+   *  varying inputs of a mesh bucket.  Thread safe.
+   */
+  void values( const int npts, const double* const* x, double* result ) const;
+
+  /**
+   *  As above, for several splines on the same mesh (see same_mesh()).
+   *  The basis functions of each point are computed once and contracted
+   *  with the control points of every spline; results[s][i] is spline s
+   *  at point i.
+   */
+  static void values( const std::vector<const BSpline*> & splines,
+                      const int npts,
+                      const double* const* x,
+                      double* const* results );
+
+  /**
+   *  Compute the nonzero basis functions of every dimension at x.  For
+   *  dimension d, N[d*maxBasis+j] weights control point shift[d]+j.
+   */
+  void compute_basis( const double* x, int* span, int* shift, double* N ) const;
+
+  /** Contract basis functions from compute_basis() with the control points */
+  virtual double basis_value( const int* shift, const double* N ) const = 0;
+
+  /**
+   *  The 1-D spline that parameterizes independent variable d; taken from
+   *  the first lower dimensional spline, so only meaningful for all of
+   *  them if uniform_axes().
+   */
+  virtual const BSpline1D & axis( const int d ) const = 0;
+
+  /**
+   *  True if every lower dimensional spline has the knots and bounds of
+   *  axis(), so that compute_basis() applies to the whole tensor product.
+   *  Otherwise each lower dimensional spline computes its own basis.
+   */
+  bool uniform_axes() const{ return uniformAxes_; }
+
+  /**
+   *  True if both splines have uniform axes and the same order, knots and
+   *  bounds in every dimension, so that basis functions computed by one
+   *  apply to both.
+   */
+  bool same_mesh( const BSpline & other ) const;
+
   /**
    *  Read a spline from an HDF5 database.  The file should be opened
    *  and an hdf5 "group" specified.  This spline will be read from the
@@ -71,9 +133,13 @@ class BSpline{
 
  protected:
 
+  /** span_value() for splines without uniform_axes() */
+  virtual double nonuniform_value( const double* x, int* span ) const;
+
   int order_;
   const int dim_;
   const bool enableValueClipping_;
+  bool uniformAxes_;
 
  private:
 
@@ -132,6 +198,16 @@ class BSpline1D : public BSpline{
   double value( const double* indepVar ) const;
   inline double value( const double & x ) const{ return value(&x); }
 
+  double basis_value( const int* shift, const double* N ) const;
+  const BSpline1D & axis( const int ) const { return *this; }
+
+  /**
+   *  Compute the order+1 nonzero basis functions at indepVar into N,
+   *  starting the knot span search from span.  Returns the index of the
+   *  control point weighted by N[0].
+   */
+  int basis( const double indepVar, int & span, double* N ) const;
+
   inline const std::vector<double> & get_control_pts() const{ return controlPts_; }
   inline       std::vector<double> & get_control_pts()      { return controlPts_; }
   inline const std::vector<double> & get_knot_vector() const{ return knots_; };
@@ -232,6 +308,8 @@ class BSpline2D : public BSpline{
    *  given value of the dependent variable.  Ordering is [x1,x2]
    */
   double value( const double* indepVar ) const;
+  double basis_value( const int* shift, const double* N ) const;
+  const BSpline1D & axis( const int d ) const;
 
   void write_hdf5( H5IO & io ) const;
   void  read_hdf5( H5IO & io );
@@ -250,6 +328,8 @@ class BSpline2D : public BSpline{
 
  private:
 
+  double nonuniform_value( const double* x, int* span ) const;
+
   std::vector<const BSpline1D*> dim2Splines_;
   BSpline1D * sp1_;
 
@@ -316,6 +396,8 @@ class BSpline3D : public BSpline{
    *  the independent variables.  Ordering is [x1,x2,x3].
    */
   double value( const double* ) const;
+  double basis_value( const int* shift, const double* N ) const;
+  const BSpline1D & axis( const int d ) const;
 
   void write_hdf5( H5IO & io ) const;
   void  read_hdf5( H5IO & io );
@@ -334,6 +416,8 @@ class BSpline3D : public BSpline{
 
  private:
 
+  double nonuniform_value( const double* x, int* span ) const;
+
   const int n1_, n2_, n3_;  // number of control points for each dimension
   std::vector<const BSpline2D*> sp2d_;
   BSpline1D * sp1_;
@@ -404,6 +488,8 @@ class BSpline4D : public BSpline{
    *  the independent variables.  Ordering is [x1,x2,x3,x4].
    */
   double value( const double* x ) const;
+  double basis_value( const int* shift, const double* N ) const;
+  const BSpline1D & axis( const int d ) const;
 
   void write_hdf5( H5IO & io ) const;
   void  read_hdf5( H5IO & io );
@@ -422,6 +508,8 @@ class BSpline4D : public BSpline{
 
  private:
 
+  double nonuniform_value( const double* x, int* span ) const;
+
   const int n1_, n2_, n3_, n4_;
   std::vector<const BSpline3D*> sp3d_;
   BSpline1D * sp1_;
@@ -495,6 +583,8 @@ class BSpline5D : public BSpline{
    *  the independent variables.  Ordering is [x1,x2,x3,x4,x5].
    */
   double value( const double* x ) const;
+  double basis_value( const int* shift, const double* N ) const;
+  const BSpline1D & axis( const int d ) const;
 
   void write_hdf5( H5IO & io ) const;
   void  read_hdf5( H5IO & io );
@@ -513,6 +603,8 @@ class BSpline5D : public BSpline{
 
  private:
 
+  double nonuniform_value( const double* x, int* span ) const;
+
   const int n1_, n2_, n3_, n4_, n5_;
   std::vector<const BSpline4D*> sp4d_;
   BSpline1D * sp1_;
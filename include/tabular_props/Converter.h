@@ -66,6 +66,20 @@ class Converter {
    */
   virtual double query( const std::vector<double> &inputs ) const = 0;
 
+  /**
+   *  Perform the calculation at numPoints sets of input variables.  The
+   *  default evaluates query() point by point in a critical section, since
+   *  converters may keep buffers of their own; reentrant converters
+   *  override this.
+   *
+   *  @param numPoints : Number of points to evaluate
+   *  @param inputs : Per input variable, an array of numPoints values
+   *  @param result : The numPoints computed values
+   */
+  virtual void query( const unsigned int numPoints,
+                      const std::vector<const double *> &inputs,
+                      double *result ) const;
+
   /** Print a summary of this Converter configuration */
   void print_summary() const;
 
@@ -111,6 +125,9 @@ class NameConverter : public Converter {
                  const std::string & inputName );
 
   virtual double query( const std::vector<double>  &inputs ) const;
+  virtual void query( const unsigned int numPoints,
+                      const std::vector<const double *> &inputs,
+                      double *result ) const;
 
  private:
   NameConverter operator=( const NameConverter & );  // No assignment
@@ -149,6 +166,9 @@ class ChiConverter : public Converter {
    *  @result : The state variable value interpolated from the table
    */
   virtual double query( const std::vector<double>  &inputs ) const;
+  virtual void query( const unsigned int numPoints,
+                      const std::vector<const double *> &inputs,
+                      double *result ) const;
 
   /** Read this Converter from the provided I/O device */
   virtual void read_hdf5( H5IO & io );
@@ -190,6 +210,9 @@ class DeltaChiConverter : public Converter {
    *  @result : The state variable value interpolated from the table
    */
   virtual double query( const std::vector<double>  &inputs ) const;
+  virtual void query( const unsigned int numPoints,
+                      const std::vector<const double *> &inputs,
+                      double *result ) const;
 
   /** Read this Converter from the provided I/O device */
   virtual void read_hdf5( H5IO & io );
@@ -232,6 +255,9 @@ class GammaConverter : public Converter {
    *  @result : The state variable value interpolated from the table
    */
   virtual double query( const std::vector<double>  &inputs ) const;
+  virtual void query( const unsigned int numPoints,
+                      const std::vector<const double *> &inputs,
+                      double *result ) const;
 
   /** Read this Converter from the provided I/O device */
   virtual void read_hdf5( H5IO & io );
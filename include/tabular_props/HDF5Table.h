@@ -95,6 +95,35 @@ class HDF5Table
    */
   double query( const std::vector<double> &inputs ) const;
 
+  /**
+   *  Return the property values at numPoints sets of input variables, with
+   *  the same clipping as query().  Only local scratch is used, so calls
+   *  from several threads may overlap; clipping diagnostics are updated
+   *  once per call, and converters without a reentrant batched query are
+   *  serialized (see Converter::query).
+   *
+   *  @param numPoints : Number of points to evaluate
+   *  @param inputs : Per input variable, an array of numPoints values
+   *  @param result : The numPoints properties as a function of the inputs
+   */
+  void query( const unsigned int numPoints,
+              const std::vector<const double *> &inputs,
+              double *result ) const;
+
+  /**
+   *  Fused form of the above for tables that share_lookup(); the table
+   *  inputs and basis functions are computed once per point and used for
+   *  every table.  results[t] receives the numPoints values of tables[t].
+   */
+  static void query( const std::vector<const HDF5Table *> &tables,
+                     const unsigned int numPoints,
+                     const std::vector<const double *> &inputs,
+                     double * const *results );
+
+  /** True if other takes the same inputs through the same clipping,
+   *  scaling and table mesh, so that the two may be queried together. */
+  bool shares_lookup( const HDF5Table &other ) const;
+
   /**
    *  Return the property value as a function of the provided input variables.
    *  WARNING: No input bounds clipping is enforced, and no logs are stored
@@ -155,6 +184,19 @@ class HDF5Table
   // Add the current values to the clipping event log
   void log_clip_event( const std::vector<double> & values ) const;
 
+  // Map, clip and scale a batch of inputs into per dimension spline inputs
+  void prepare_lookup( const unsigned int numPoints,
+                       const std::vector<const double *> &inputs,
+                       std::vector<double> &lookup,
+                       std::vector<double> &lookupChecked,
+                       std::vector<const double *> &splineInputs,
+                       std::vector<char> &clipped ) const;
+
+  // Count and log the clipped points of a batch
+  void record_clipping( const unsigned int numPoints,
+                        const std::vector<double> &lookup,
+                        const std::vector<char> &clipped ) const;
+
   /** Rewire the inputs and outputs of the Table and any optional Converters
    *  so that they talk to each other properly and inputs to the HDF5Table will
    *  be sent to the correct object. */
@@ -13,7 +13,9 @@
 #include <vector>
 #include <utility>
 
+#include <NaluProfiler.h>
 #include <Realm.h>
+#include <Simulation.h>
 #include <stk_util/parallel/Parallel.hpp>
 #include <stk_util/parallel/ParallelReduce.hpp>
 
@@ -183,6 +185,8 @@ public :
   void update_values()
   {
     if (ghosting_) {
+      stk::diag::Timer commTimer("TransferGhosting", Simulation::communicationTimer());
+      ProfileBlock commBlock(commTimer);
       std::vector<const stk::mesh::FieldBase *> fields(fromFieldVec_.begin(), fromFieldVec_.end());
       if (mesh_modified_) {
         // Copy coordinates to the newly ghosted nodes
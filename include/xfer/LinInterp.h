@@ -47,6 +47,10 @@ public :
   static void apply (MeshB         &ToPoints,
       const MeshA         &FromElem,
       const EntityKeyMap &RangeToDomain) ;
+
+  static void build_operator (MeshB         &ToPoints,
+      const MeshA         &FromElem,
+      const EntityKeyMap &RangeToDomain) ;
 };
 
 template <class FROM, class TO>  void LinInterp<FROM,TO>::filter_to_nearest (
@@ -124,30 +128,38 @@ template <class FROM, class TO>  void LinInterp<FROM,TO>::filter_to_nearest (
 }
 
 
-template <class FROM, class TO>  void LinInterp<FROM,TO>::apply 
+template <class FROM, class TO>  void LinInterp<FROM,TO>::build_operator
        (MeshB              &ToPoints,
         const MeshA        &FromElem,
         const EntityKeyMap &RangeToDomain) {
-  
+
   const stk::mesh::BulkData &fromBulkData = FromElem.fromBulkData_;
   stk::mesh::BulkData         &toBulkData = ToPoints.toBulkData_;
   Realm &fromRealm = FromElem.fromRealm_;
 
+  ToPoints.operatorTargets_.clear();
+  ToPoints.operatorOffsets_.assign(1, 0);
+  ToPoints.operatorDonors_.clear();
+  ToPoints.operatorWeights_.clear();
+
+  std::vector<double> identity;
+  std::vector<double> weights;
+
   typename EntityKeyMap::const_iterator ii;
-  for(ii=RangeToDomain.begin(); ii!=RangeToDomain.end(); ++ii ) { 
-    
+  for(ii=RangeToDomain.begin(); ii!=RangeToDomain.end(); ++ii ) {
+
     const stk::mesh::EntityKey thePt  = ii->first;
-    const stk::mesh::EntityKey theBox = ii->second; 
-    
+    const stk::mesh::EntityKey theBox = ii->second;
+
     if (1 != ToPoints.TransferInfo_.count(thePt)) {
-      if (0 == ToPoints.TransferInfo_.count(thePt)) 
+      if (0 == ToPoints.TransferInfo_.count(thePt))
         throw std::runtime_error("Key not found in database");
-      else  
+      else
         throw std::runtime_error("Too many Keys found in database");
     }
     const std::vector<double> &isoParCoords_ = ToPoints.TransferInfo_[thePt];
     stk::mesh::Entity theNode =   toBulkData.get_entity(thePt);
-    stk::mesh::Entity theElem = fromBulkData.get_entity(theBox);    
+    stk::mesh::Entity theElem = fromBulkData.get_entity(theBox);
 
     const stk::mesh::Bucket &theBucket = fromBulkData.bucket(theElem);
     const stk::topology &theElemTopo = theBucket.topology();
@@ -157,35 +169,66 @@ template <class FROM, class TO>  void LinInterp<FROM,TO>::apply
     const int num_nodes = fromBulkData.num_nodes(theElem);
     const int nodesPerElement = meSCS->nodesPerElement_;
 
-    for (unsigned n=0; n!=FromElem.fromFieldVec_.size(); ++n) {
+    // interpolation is linear in the nodal values; interpolating the
+    // identity yields the weight of each node
+    identity.assign(nodesPerElement*nodesPerElement, 0.0);
+    for ( int ni = 0; ni < nodesPerElement; ++ni )
+      identity[ni*nodesPerElement + ni] = 1.0;
+    weights.resize(nodesPerElement);
+    meSCS->interpolatePoint(nodesPerElement,
+                            &isoParCoords_[0],
+                            &identity[0],
+                            &weights[0]);
+
+    ToPoints.operatorTargets_.push_back(theNode);
+    for ( int ni = 0; ni < num_nodes; ++ni ) {
+      ToPoints.operatorDonors_.push_back(elem_node_rels[ni]);
+      ToPoints.operatorWeights_.push_back(weights[ni]);
+    }
+    ToPoints.operatorOffsets_.push_back(ToPoints.operatorDonors_.size());
+  }
 
-      // extract field
-      const stk::mesh::FieldBase *toFieldBaseField = ToPoints.toFieldVec_[n];
+  ToPoints.operatorFromSyncCount_ = fromBulkData.synchronized_count();
+  ToPoints.operatorToSyncCount_ = toBulkData.synchronized_count();
+}
 
-      // FixMe: integers are problematic for now...
-      const size_t sizeOfField = field_bytes_per_entity(*toFieldBaseField, theNode) / sizeof(double);
-      std::vector <double > Coeff(nodesPerElement*sizeOfField);
 
-      // now load the elemental values for future interpolation; fill in connected nodes
-      for ( int ni = 0; ni < num_nodes; ++ni ) { 
-        stk::mesh::Entity node = elem_node_rels[ni];
+template <class FROM, class TO>  void LinInterp<FROM,TO>::apply 
+       (MeshB              &ToPoints,
+        const MeshA        &FromElem,
+        const EntityKeyMap &RangeToDomain) {
 
-        const stk::mesh::FieldBase *fromFieldBaseField = FromElem.fromFieldVec_[n];
-        const double *theField = (double*)stk::mesh::field_data(*fromFieldBaseField, node );
+  // weights depend on the meshes only; the search result is reused
+  // until either mesh is modified
+  if ( !ToPoints.operator_is_current(FromElem.fromBulkData_, RangeToDomain.size()) )
+    build_operator(ToPoints, FromElem, RangeToDomain);
 
-        for ( size_t j = 0; j < sizeOfField; ++j) {
-          const int offSet = j*nodesPerElement + ni; 
-          Coeff[offSet] = theField[j];
-        }   
-      }
+  const size_t numTargets = ToPoints.operatorTargets_.size();
+
+  for (unsigned n=0; n!=FromElem.fromFieldVec_.size(); ++n) {
 
+    const stk::mesh::FieldBase *fromFieldBaseField = FromElem.fromFieldVec_[n];
+    const stk::mesh::FieldBase *toFieldBaseField = ToPoints.toFieldVec_[n];
+
+    for ( size_t k = 0; k < numTargets; ++k ) {
+      stk::mesh::Entity theNode = ToPoints.operatorTargets_[k];
+
+      // FixMe: integers are problematic for now...
+      const size_t sizeOfField = field_bytes_per_entity(*toFieldBaseField, theNode) / sizeof(double);
       double * toField = (double*)stk::mesh::field_data(*toFieldBaseField, theNode);
       if (!toField) throw std::runtime_error("Receiving field undefined on mesh object.");
-      meSCS->interpolatePoint(sizeOfField,
-                              &isoParCoords_[0],
-                              &Coeff[0],
-                              toField);
-    }   
+
+      for ( size_t j = 0; j < sizeOfField; ++j )
+        toField[j] = 0.0;
+
+      // sparse gather of the donor values
+      for ( size_t d = ToPoints.operatorOffsets_[k]; d < ToPoints.operatorOffsets_[k+1]; ++d ) {
+        const double *theField = (double*)stk::mesh::field_data(*fromFieldBaseField, ToPoints.operatorDonors_[d]);
+        const double weight = ToPoints.operatorWeights_[d];
+        for ( size_t j = 0; j < sizeOfField; ++j )
+          toField[j] += weight*theField[j];
+      }
+    }
   }
 }
 
@@ -9,6 +9,7 @@
 #ifndef ToMesh_h
 #define ToMesh_h
 
+#include <limits>
 #include <string>
 #include <vector>
 #include <utility>
@@ -69,7 +70,9 @@ public :
     toFieldVec_   (get_fields(toMetaData, VarPairName)),
     toMeshPart_(toMeshPart),
     comm_(comm),
-    radius_(radius)   {}
+    radius_(radius),
+    operatorFromSyncCount_(std::numeric_limits<size_t>::max()),
+    operatorToSyncCount_(std::numeric_limits<size_t>::max()) {}
 
   ~ToMesh(){};
 
@@ -138,6 +141,25 @@ public :
   typedef std::map<stk::mesh::EntityKey, std::vector<double> > TransferInfo;
   TransferInfo TransferInfo_;
 
+  // sparse interpolation operator; target k receives the weighted sum over
+  // donors [operatorOffsets_[k], operatorOffsets_[k+1]). Donors and weights
+  // hold until either mesh is modified
+  bool operator_is_current(
+    const stk::mesh::BulkData &fromBulkData,
+    const size_t numTargets) const
+  {
+    return operatorFromSyncCount_ == fromBulkData.synchronized_count()
+      && operatorToSyncCount_ == toBulkData_.synchronized_count()
+      && operatorTargets_.size() == numTargets;
+  }
+
+  std::vector<stk::mesh::Entity> operatorTargets_;
+  std::vector<size_t> operatorOffsets_;
+  std::vector<stk::mesh::Entity> operatorDonors_;
+  std::vector<double> operatorWeights_;
+  size_t operatorFromSyncCount_;
+  size_t operatorToSyncCount_;
+
 };
 
 } // namespace nalu